@@ -0,0 +1,422 @@
+// Hook overhead microbenchmark for safetyhook (Linux).
+// Hooks synthetic functions shaped like the fix's targets and measures creation, destruction, enable/disable and per-call cost.
+// Usage: HookBench [output.json] [calls per thread]
+
+#include <safetyhook.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define NOINLINE __attribute__((noinline))
+
+using Clock = std::chrono::steady_clock;
+
+// Settings
+int iCreateIterations = 200;
+int iToggleIterations = 1000;
+long long iCallsPerThread = 2000000;
+std::vector<unsigned int> ThreadCounts;
+
+// Synthetic targets
+// Shaped like the gameplay FOV hook (float in xmm0) and the HUD size hook (pointer + ints written to a struct).
+float fFOVMulti = 1.00f;
+
+struct HUDObject
+{
+    float fHorFOV;
+    float fVertFOV;
+    int iWidth;
+    int iHeight;
+    float fWidthScale;
+    float fHeightScale;
+};
+
+extern "C" NOINLINE float ScaleFOV(float fFOV)
+{
+    asm volatile("");
+    return fFOV * 0.75f + 0.10f;
+}
+
+extern "C" NOINLINE void WriteHUDSize(HUDObject* pHUD, int iWidth, int iHeight)
+{
+    asm volatile("");
+    pHUD->iWidth = iWidth;
+    pHUD->iHeight = iHeight;
+    pHUD->fWidthScale = 2.00f / (float)iWidth;
+    pHUD->fHeightScale = 2.00f / (float)iHeight;
+}
+
+class HUDRenderer
+{
+public:
+    virtual ~HUDRenderer() = default;
+    virtual NOINLINE float GetFOV(float fFOV) { asm volatile(""); return fFOV * 0.75f + 0.10f; }
+};
+
+// Called through volatile pointers so the compiler can't inline or fold the targets away
+float (*volatile pScaleFOV)(float) = &ScaleFOV;
+void (*volatile pWriteHUDSize)(HUDObject*, int, int) = &WriteHUDSize;
+
+// Hook destinations
+SafetyHookInline ScaleFOVInlineHook{};
+SafetyHookInline WriteHUDSizeInlineHook{};
+SafetyHookVmt HUDRendererVmtHook{};
+safetyhook::VmHook GetFOVVmHook{};
+
+float ScaleFOVDetour(float fFOV)
+{
+    return ScaleFOVInlineHook.call<float>(fFOV * fFOVMulti);
+}
+
+void WriteHUDSizeDetour(HUDObject* pHUD, int iWidth, int /*iHeight*/)
+{
+    WriteHUDSizeInlineHook.call<void>(pHUD, iWidth, 1080);
+}
+
+// Free function rather than a member so the VMT slot holds a plain code pointer
+float GetFOVDetour(HUDRenderer* pThis, float fFOV)
+{
+    return GetFOVVmHook.thiscall<float>(pThis, fFOV * fFOVMulti);
+}
+
+void ScaleFOVMidDetour(SafetyHookContext& ctx)
+{
+    ctx.xmm0.f32[0] *= fFOVMulti;
+}
+
+void WriteHUDSizeMidDetour(SafetyHookContext& ctx)
+{
+    if (ctx.rdi)
+        ctx.rdx = 1080;
+}
+
+// Results
+struct CallResult
+{
+    unsigned int iThreads;
+    double fNsPerCall;
+    double fCallsPerSec;
+};
+
+// Timings that don't apply to a hook type are left at -1 (i.e enable/disable for VmtHook, apply/remove for the others)
+struct BenchResult
+{
+    std::string sHook;
+    std::string sTarget;
+    double fCreateNs = -1.00;
+    double fDestroyNs = -1.00;
+    double fEnableNs = -1.00;
+    double fDisableNs = -1.00;
+    double fApplyNs = -1.00;
+    double fRemoveNs = -1.00;
+    std::vector<CallResult> Calls;
+};
+
+double ElapsedNs(Clock::time_point Start)
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - Start).count();
+}
+
+// Average cost of creating and of destroying a hook, timed separately over iCreateIterations.
+void TimeCreateDestroy(BenchResult& Result, const std::function<void()>& Create, const std::function<void()>& Destroy)
+{
+    double fCreateNs = 0.00;
+    double fDestroyNs = 0.00;
+    for (int i = 0; i < iCreateIterations; ++i) {
+        auto Start = Clock::now();
+        Create();
+        fCreateNs += ElapsedNs(Start);
+
+        Start = Clock::now();
+        Destroy();
+        fDestroyNs += ElapsedNs(Start);
+    }
+    Result.fCreateNs = fCreateNs / (double)iCreateIterations;
+    Result.fDestroyNs = fDestroyNs / (double)iCreateIterations;
+}
+
+// Steady-state cost of fn with iThreads threads calling it concurrently.
+CallResult TimeCalls(unsigned int iThreads, void (*fn)(unsigned int, long long))
+{
+    std::atomic<unsigned int> iReady = 0;
+    std::atomic<bool> bGo = false;
+    std::vector<std::thread> Threads;
+
+    for (unsigned int i = 0; i < iThreads; ++i) {
+        Threads.emplace_back([&, i]() {
+            ++iReady;
+            while (!bGo.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            fn(i, iCallsPerThread);
+        });
+    }
+
+    while (iReady.load() != iThreads)
+        std::this_thread::yield();
+
+    auto Start = Clock::now();
+    bGo.store(true, std::memory_order_release);
+    for (auto& thread : Threads)
+        thread.join();
+    double fElapsedNs = ElapsedNs(Start);
+
+    return { iThreads, fElapsedNs / (double)iCallsPerThread, (double)(iCallsPerThread * iThreads) / (fElapsedNs / 1e9) };
+}
+
+void CallScaleFOV(unsigned int /*iThread*/, long long iCalls)
+{
+    float fSink = 0.00f;
+    for (long long i = 0; i < iCalls; ++i)
+        fSink += pScaleFOV(90.00f);
+    asm volatile("" : : "r"(fSink));
+}
+
+void CallWriteHUDSize(unsigned int /*iThread*/, long long iCalls)
+{
+    HUDObject HUD{};
+    for (long long i = 0; i < iCalls; ++i)
+        pWriteHUDSize(&HUD, 1920, 1080);
+    asm volatile("" : : "r"(HUD.iHeight));
+}
+
+// One renderer per calling thread. The VMT hook is applied to all of them before timing starts.
+std::vector<std::unique_ptr<HUDRenderer>> HookedRenderers;
+
+void CallGetFOV(unsigned int iThread, long long iCalls)
+{
+    HUDRenderer* volatile pRenderer = HookedRenderers[iThread].get();
+
+    float fSink = 0.00f;
+    for (long long i = 0; i < iCalls; ++i)
+        fSink += pRenderer->GetFOV(90.00f);
+    asm volatile("" : : "r"(fSink));
+}
+
+void CallGetFOVUnhooked(unsigned int /*iThread*/, long long iCalls)
+{
+    HUDRenderer Renderer{};
+    HUDRenderer* volatile pRenderer = &Renderer;
+
+    float fSink = 0.00f;
+    for (long long i = 0; i < iCalls; ++i)
+        fSink += pRenderer->GetFOV(90.00f);
+    asm volatile("" : : "r"(fSink));
+}
+
+std::vector<CallResult> TimeCallsAllThreads(void (*fn)(unsigned int, long long))
+{
+    std::vector<CallResult> Results;
+    for (auto iThreads : ThreadCounts)
+        Results.push_back(TimeCalls(iThreads, fn));
+    return Results;
+}
+
+BenchResult BenchBaseline(const std::string& sTarget, void (*fn)(unsigned int, long long))
+{
+    BenchResult Result{ "none", sTarget };
+    Result.Calls = TimeCallsAllThreads(fn);
+    return Result;
+}
+
+BenchResult BenchMid(const std::string& sTarget, void* pTarget, safetyhook::MidHookFn Destination, void (*fn)(unsigned int, long long))
+{
+    BenchResult Result{ "create_mid", sTarget };
+
+    SafetyHookMid Hook{};
+    TimeCreateDestroy(Result,
+        [&]() { Hook = safetyhook::create_mid(pTarget, Destination); },
+        [&]() { Hook = {}; });
+
+    Hook = safetyhook::create_mid(pTarget, Destination);
+    if (!Hook) {
+        std::cerr << "create_mid failed for " << sTarget << std::endl;
+        return Result;
+    }
+
+    double fEnableNs = 0.00;
+    double fDisableNs = 0.00;
+    for (int i = 0; i < iToggleIterations; ++i) {
+        auto Start = Clock::now();
+        (void)Hook.disable();
+        fDisableNs += ElapsedNs(Start);
+
+        Start = Clock::now();
+        (void)Hook.enable();
+        fEnableNs += ElapsedNs(Start);
+    }
+    Result.fEnableNs = fEnableNs / (double)iToggleIterations;
+    Result.fDisableNs = fDisableNs / (double)iToggleIterations;
+
+    Result.Calls = TimeCallsAllThreads(fn);
+    return Result;
+}
+
+BenchResult BenchInline(const std::string& sTarget, SafetyHookInline& Hook, void* pTarget, void* pDestination, void (*fn)(unsigned int, long long))
+{
+    BenchResult Result{ "create_inline", sTarget };
+
+    TimeCreateDestroy(Result,
+        [&]() { Hook = safetyhook::create_inline(pTarget, pDestination); },
+        [&]() { Hook = {}; });
+
+    Hook = safetyhook::create_inline(pTarget, pDestination);
+    if (!Hook) {
+        std::cerr << "create_inline failed for " << sTarget << std::endl;
+        return Result;
+    }
+
+    double fEnableNs = 0.00;
+    double fDisableNs = 0.00;
+    for (int i = 0; i < iToggleIterations; ++i) {
+        auto Start = Clock::now();
+        (void)Hook.disable();
+        fDisableNs += ElapsedNs(Start);
+
+        Start = Clock::now();
+        (void)Hook.enable();
+        fEnableNs += ElapsedNs(Start);
+    }
+    Result.fEnableNs = fEnableNs / (double)iToggleIterations;
+    Result.fDisableNs = fDisableNs / (double)iToggleIterations;
+
+    Result.Calls = TimeCallsAllThreads(fn);
+    Hook = {};
+    return Result;
+}
+
+BenchResult BenchVmt()
+{
+    // VmtHook has no enable/disable, so apply/remove on an object is timed and reported under its own keys
+    BenchResult Result{ "VmtHook", "vfunc_fov_scale" };
+    HUDRenderer Renderer{};
+
+    TimeCreateDestroy(Result,
+        [&]() {
+            HUDRendererVmtHook = safetyhook::create_vmt(&Renderer);
+            GetFOVVmHook = safetyhook::create_vm(HUDRendererVmtHook, 2, &GetFOVDetour);
+        },
+        [&]() {
+            GetFOVVmHook = {};
+            HUDRendererVmtHook = {};
+        });
+
+    HUDRendererVmtHook = safetyhook::create_vmt(&Renderer);
+    GetFOVVmHook = safetyhook::create_vm(HUDRendererVmtHook, 2, &GetFOVDetour); // Index 0/1 are the destructors
+
+    double fApplyNs = 0.00;
+    double fRemoveNs = 0.00;
+    for (int i = 0; i < iToggleIterations; ++i) {
+        auto Start = Clock::now();
+        HUDRendererVmtHook.remove(&Renderer);
+        fRemoveNs += ElapsedNs(Start);
+
+        Start = Clock::now();
+        HUDRendererVmtHook.apply(&Renderer);
+        fApplyNs += ElapsedNs(Start);
+    }
+    HUDRendererVmtHook.remove(&Renderer);
+    Result.fApplyNs = fApplyNs / (double)iToggleIterations;
+    Result.fRemoveNs = fRemoveNs / (double)iToggleIterations;
+
+    // Apply/remove stays outside the timed region so per-call numbers are comparable with the other hooks
+    for (unsigned int i = 0; i < ThreadCounts.back(); ++i) {
+        HookedRenderers.push_back(std::make_unique<HUDRenderer>());
+        HUDRendererVmtHook.apply(HookedRenderers.back().get());
+    }
+    Result.Calls = TimeCallsAllThreads(CallGetFOV);
+    for (auto& renderer : HookedRenderers)
+        HUDRendererVmtHook.remove(renderer.get());
+    HookedRenderers.clear();
+
+    GetFOVVmHook = {};
+    HUDRendererVmtHook = {};
+    return Result;
+}
+
+std::string ToJson(const std::vector<BenchResult>& Results)
+{
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"platform\": \"linux\",\n";
+    json << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+    json << "  \"create_iterations\": " << iCreateIterations << ",\n";
+    json << "  \"toggle_iterations\": " << iToggleIterations << ",\n";
+    json << "  \"calls_per_thread\": " << iCallsPerThread << ",\n";
+    json << "  \"results\": [\n";
+    for (std::size_t i = 0; i < Results.size(); ++i) {
+        const auto& result = Results[i];
+        json << "    {\n";
+        json << "      \"hook\": \"" << result.sHook << "\",\n";
+        json << "      \"target\": \"" << result.sTarget << "\",\n";
+        json << "      \"create_ns\": " << result.fCreateNs << ",\n";
+        json << "      \"destroy_ns\": " << result.fDestroyNs << ",\n";
+        json << "      \"enable_ns\": " << result.fEnableNs << ",\n";
+        json << "      \"disable_ns\": " << result.fDisableNs << ",\n";
+        json << "      \"apply_ns\": " << result.fApplyNs << ",\n";
+        json << "      \"remove_ns\": " << result.fRemoveNs << ",\n";
+        json << "      \"calls\": [";
+        for (std::size_t j = 0; j < result.Calls.size(); ++j) {
+            const auto& call = result.Calls[j];
+            json << (j ? ", " : "") << "{ \"threads\": " << call.iThreads << ", \"ns_per_call\": " << call.fNsPerCall << ", \"calls_per_sec\": " << call.fCallsPerSec << " }";
+        }
+        json << "]\n";
+        json << "    }" << (i + 1 < Results.size() ? "," : "") << "\n";
+    }
+    json << "  ]\n";
+    json << "}\n";
+    return json.str();
+}
+
+int main(int argc, char** argv)
+{
+    std::string sOutputFile = argc > 1 ? argv[1] : "";
+    if (argc > 2)
+        iCallsPerThread = std::max(1LL, std::atoll(argv[2]));
+
+    // 1, 2, 4 ... up to the hardware thread count
+    unsigned int iMaxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int i = 1; i < iMaxThreads; i *= 2)
+        ThreadCounts.push_back(i);
+    ThreadCounts.push_back(iMaxThreads);
+
+    std::vector<BenchResult> Results;
+
+    Results.push_back(BenchBaseline("fov_scale", CallScaleFOV));
+    Results.push_back(BenchMid("fov_scale", (void*)&ScaleFOV, ScaleFOVMidDetour, CallScaleFOV));
+    Results.push_back(BenchInline("fov_scale", ScaleFOVInlineHook, (void*)&ScaleFOV, (void*)&ScaleFOVDetour, CallScaleFOV));
+
+    Results.push_back(BenchBaseline("hud_size_write", CallWriteHUDSize));
+    Results.push_back(BenchMid("hud_size_write", (void*)&WriteHUDSize, WriteHUDSizeMidDetour, CallWriteHUDSize));
+    Results.push_back(BenchInline("hud_size_write", WriteHUDSizeInlineHook, (void*)&WriteHUDSize, (void*)&WriteHUDSizeDetour, CallWriteHUDSize));
+
+    Results.push_back(BenchBaseline("vfunc_fov_scale", CallGetFOVUnhooked));
+    Results.push_back(BenchVmt());
+
+    std::string sJson = ToJson(Results);
+    if (sOutputFile.empty()) {
+        std::cout << sJson;
+    }
+    else {
+        std::ofstream OutputFile(sOutputFile);
+        if (!OutputFile) {
+            std::cerr << "Could not open " << sOutputFile << std::endl;
+            return 1;
+        }
+        OutputFile << sJson;
+        std::cout << "Wrote results to " << sOutputFile << std::endl;
+    }
+
+    return 0;
+}
@@ -8,6 +8,8 @@
 
 #define spdlog_confparse(var) spdlog::info("Config Parse: {}: {}", #var, var)
 
+using namespace std::chrono_literals;
+
 HMODULE exeModule = GetModuleHandle(NULL);
 HMODULE thisModule;
 
@@ -30,12 +32,24 @@ std::string sExeName;
 std::pair DesktopDimensions = { 0,0 };
 const float fPi = 3.1415926535f;
 const float fNativeAspect = 16.00f / 9.00f;
-float fAspectRatio = fNativeAspect;
-float fAspectMultiplier;
-float fHUDWidth;
-float fHUDWidthOffset;
-float fHUDHeight;
-float fHUDHeightOffset;
+
+// Display state
+// Immutable snapshot of everything derived from the current resolution.
+// A new snapshot is published on each resolution change so hooks never see a mix of old and new values.
+struct DisplayState
+{
+    std::uint64_t iGeneration = 1;
+    int iResX = 0;
+    int iResY = 0;
+    float fAspectRatio = fNativeAspect;
+    float fAspectMultiplier = 1.00f;
+    float fHUDWidth = 0.00f;
+    float fHUDWidthOffset = 0.00f;
+    float fHUDHeight = 0.00f;
+    float fHUDHeightOffset = 0.00f;
+};
+const DisplayState DefaultDisplayState{};
+std::atomic<const DisplayState*> pDisplayState = &DefaultDisplayState;
 
 // Ini variables
 bool bCustomRes;
@@ -47,50 +61,160 @@ float fBattleFOVMulti;
 bool bIntroSkip;
 
 // Variables
-int iCurrentResX;
-int iCurrentResY;
-std::uint8_t* pHUDObject = nullptr;
-int iHUDObjectX;
-int iHUDObjectY;
 const float fHUDFOV = (1.00f / std::tanf(0.7853981853f / 2.00f));
-bool bHUDNeedsResize = true;
+std::atomic<std::uint64_t> iHUDResizedGeneration = 0;
 bool bHasSkippedIntro;
 
-void CalculateAspectRatio(bool bLog)
+// HUD fixes
+// Only scanned for and hooked once the resolution first stops being 16:9.
+SafetyHookMid HUDSizeMidHook{};
+SafetyHookMid HUDObjectsMidHook{};
+std::uint8_t* MarkersCullingAddress = nullptr;
+char MarkersCullingOriginalBytes[2];
+std::atomic<bool> bHUDFixesWanted = false;
+std::mutex HUDActivationMutex;
+bool bHUDFixesInstalled = false;
+
+// Scan scheduler
+// Features register their signatures with a priority and a deadline. Scans run highest priority first across a few workers and
+// each feature's hooks are installed as soon as its own signatures resolve, so early-firing targets aren't stuck behind unrelated scans.
+struct ScanTask
+{
+    std::string sName;
+    int iPriority;
+    std::chrono::milliseconds Deadline;
+    std::vector<const char*> Signatures;
+    std::function<void(const std::vector<std::uint8_t*>&)> Install;
+};
+std::vector<ScanTask> StartupScans;
+std::vector<ScanTask> HUDScans;
+std::mutex ScanInstallMutex;
+const unsigned int iMaxScanWorkers = 4;
+
+const DisplayState& GetDisplayState()
+{
+    return *pDisplayState.load(std::memory_order_acquire);
+}
+
+void UpdateHUDFixes(const DisplayState& state);
+
+// RTTI class index
+// Built once on first use. Lets features anchor on a class's vtable by name instead of a byte signature.
+const Memory::RTTIIndex& GetRTTIIndex()
 {
-    if (iCurrentResX <= 0 || iCurrentResY <= 0)
+    static const Memory::RTTIIndex RTTIClasses = []() {
+        auto StartTime = std::chrono::steady_clock::now();
+        Memory::RTTIIndex index = Memory::BuildRTTIIndex(exeModule);
+        spdlog::info("RTTI Index: Indexed {:d} classes in {:d}ms.", index.Classes.size(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - StartTime).count());
+        return index;
+    }();
+    return RTTIClasses;
+}
+
+void CalculateAspectRatio(int iResX, int iResY, bool bLog)
+{
+    if (iResX <= 0 || iResY <= 0)
         return;
 
+    DisplayState state{};
+    state.iGeneration = GetDisplayState().iGeneration + 1;
+    state.iResX = iResX;
+    state.iResY = iResY;
+
     // Calculate aspect ratio
-    fAspectRatio = (float)iCurrentResX / (float)iCurrentResY;
-    fAspectMultiplier = fAspectRatio / fNativeAspect;
-
-    // HUD 
-    fHUDWidth = (float)iCurrentResY * fNativeAspect;
-    fHUDHeight = (float)iCurrentResY;
-    fHUDWidthOffset = (float)(iCurrentResX - fHUDWidth) / 2.00f;
-    fHUDHeightOffset = 0.00f;
-    if (fAspectRatio < fNativeAspect) {
-        fHUDWidth = (float)iCurrentResX;
-        fHUDHeight = (float)iCurrentResX / fNativeAspect;
-        fHUDWidthOffset = 0.00f;
-        fHUDHeightOffset = (float)(iCurrentResY - fHUDHeight) / 2.00f;
+    state.fAspectRatio = (float)iResX / (float)iResY;
+    state.fAspectMultiplier = state.fAspectRatio / fNativeAspect;
+
+    // HUD
+    state.fHUDWidth = (float)iResY * fNativeAspect;
+    state.fHUDHeight = (float)iResY;
+    state.fHUDWidthOffset = (float)(iResX - state.fHUDWidth) / 2.00f;
+    state.fHUDHeightOffset = 0.00f;
+    if (state.fAspectRatio < fNativeAspect) {
+        state.fHUDWidth = (float)iResX;
+        state.fHUDHeight = (float)iResX / fNativeAspect;
+        state.fHUDWidthOffset = 0.00f;
+        state.fHUDHeightOffset = (float)(iResY - state.fHUDHeight) / 2.00f;
     }
 
+    // Publish snapshot
+    // Old snapshots are never freed since a hook on another thread may still be reading one. Resolution changes are rare so this is only a few bytes.
+    pDisplayState.store(new DisplayState(state), std::memory_order_release);
+
     // Log details about current resolution
     if (bLog) {
         spdlog::info("----------");
-        spdlog::info("Current Resolution: Resolution: {:d}x{:d}", iCurrentResX, iCurrentResY);
-        spdlog::info("Current Resolution: fAspectRatio: {}", fAspectRatio);
-        spdlog::info("Current Resolution: fAspectMultiplier: {}", fAspectMultiplier);
-        spdlog::info("Current Resolution: fHUDWidth: {}", fHUDWidth);
-        spdlog::info("Current Resolution: fHUDHeight: {}", fHUDHeight);
-        spdlog::info("Current Resolution: fHUDWidthOffset: {}", fHUDWidthOffset);
-        spdlog::info("Current Resolution: fHUDHeightOffset: {}", fHUDHeightOffset);
+        spdlog::info("Current Resolution: Resolution: {:d}x{:d}", state.iResX, state.iResY);
+        spdlog::info("Current Resolution: fAspectRatio: {}", state.fAspectRatio);
+        spdlog::info("Current Resolution: fAspectMultiplier: {}", state.fAspectMultiplier);
+        spdlog::info("Current Resolution: fHUDWidth: {}", state.fHUDWidth);
+        spdlog::info("Current Resolution: fHUDHeight: {}", state.fHUDHeight);
+        spdlog::info("Current Resolution: fHUDWidthOffset: {}", state.fHUDWidthOffset);
+        spdlog::info("Current Resolution: fHUDHeightOffset: {}", state.fHUDHeightOffset);
+        spdlog::info("Current Resolution: Generation: {:d}", state.iGeneration);
         spdlog::info("----------");
     }
 }
 
+void RegisterScan(std::vector<ScanTask>& Tasks, const std::string& sName, int iPriority, std::chrono::milliseconds Deadline, std::vector<const char*> Signatures, std::function<void(const std::vector<std::uint8_t*>&)> Install)
+{
+    Tasks.push_back({ sName, iPriority, Deadline, std::move(Signatures), std::move(Install) });
+}
+
+void RunScans(std::vector<ScanTask>& Tasks)
+{
+    auto StartTime = std::chrono::steady_clock::now();
+
+    // Highest priority first, registration order breaks ties
+    std::stable_sort(Tasks.begin(), Tasks.end(),
+        [](const ScanTask& a, const ScanTask& b) {
+            return a.iPriority > b.iPriority;
+        });
+
+    std::atomic<std::size_t> iNextTask = 0;
+    auto ScanWorker = [&]() {
+        for (std::size_t i = iNextTask++; i < Tasks.size(); i = iNextTask++) {
+            const ScanTask& task = Tasks[i];
+
+            std::vector<std::uint8_t*> ScanResults;
+            for (const auto& signature : task.Signatures)
+                ScanResults.push_back(Memory::PatternScan(exeModule, signature));
+
+            // Only one feature patches code at a time
+            {
+                std::scoped_lock lock(ScanInstallMutex);
+                task.Install(ScanResults);
+            }
+
+            auto TimeToHook = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - StartTime);
+            if (TimeToHook > task.Deadline)
+                spdlog::warn("Scan Scheduler: {:s}: Time to hook was {:d}ms, past deadline of {:d}ms.", task.sName, TimeToHook.count(), task.Deadline.count());
+            else
+                spdlog::info("Scan Scheduler: {:s}: Time to hook was {:d}ms.", task.sName, TimeToHook.count());
+        }
+    };
+
+    // The calling thread is one of the workers
+    // Workers run at the caller's priority so early-firing scans aren't slower than when Main ran them alone
+    unsigned int iWorkers = std::clamp(std::thread::hardware_concurrency(), 1u, iMaxScanWorkers);
+    int iCallerPriority = GetThreadPriority(GetCurrentThread());
+    std::vector<std::thread> Workers;
+    for (unsigned int i = 1; i < iWorkers && i < Tasks.size(); ++i) {
+        Workers.emplace_back([&]() {
+            SetThreadPriority(GetCurrentThread(), iCallerPriority);
+            ScanWorker();
+        });
+    }
+    ScanWorker();
+    for (auto& worker : Workers)
+        worker.join();
+
+    spdlog::info("Scan Scheduler: Finished {:d} scan(s) on {:d} worker(s) in {:d}ms.", Tasks.size(), Workers.size() + 1,
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - StartTime).count());
+    Tasks.clear();
+}
+
 void Logging()
 {
     // Get path to DLL
@@ -109,7 +233,7 @@ void Logging()
     // Spdlog initialisation
     try
     {
-        logger = spdlog::basic_logger_st(sFixName, sExePath.string() + sLogFile, true);
+        logger = spdlog::basic_logger_mt(sFixName, sExePath.string() + sLogFile, true);
         spdlog::set_default_logger(logger);
         spdlog::flush_on(spdlog::level::debug);
 
@@ -188,30 +312,31 @@ void Configuration()
 void CurrentResolution()
 {
     // Current resolution
-    std::uint8_t* CurrentResolutionScanResult = Memory::PatternScan(exeModule, "41 ?? ?? 8B ?? 48 8B ?? FF 90 ?? ?? ?? ?? 84 ?? 0F 84 ?? ?? ?? ?? 44 8B ??");
-    if (CurrentResolutionScanResult) {
-        spdlog::info("Current Resolution: Address is {:s}+{:x}", sExeName.c_str(), CurrentResolutionScanResult - (std::uint8_t*)exeModule);
-        static SafetyHookMid CurrentResolutionMidHook{};
-        CurrentResolutionMidHook = safetyhook::create_mid(CurrentResolutionScanResult,
-            [](SafetyHookContext& ctx) {
-                // Get current resolution
-                int iResX = (int)ctx.rdx;
-                int iResY = (int)ctx.r8;
-
-                if (iResX != iCurrentResX || iResY != iCurrentResY) {
-                    // Log resolution
-                    iCurrentResX = iResX;
-                    iCurrentResY = iResY;
-                    CalculateAspectRatio(true);
-                    
-                    // Trigger HUD resize
-                    bHUDNeedsResize = true;
-                }
-            });
-    }
-    else {
-        spdlog::error("Current Resolution: Pattern scan failed.");
-    }
+    RegisterScan(StartupScans, "Current Resolution", 100, 1000ms, { "41 ?? ?? 8B ?? 48 8B ?? FF 90 ?? ?? ?? ?? 84 ?? 0F 84 ?? ?? ?? ?? 44 8B ??" },
+        [](const std::vector<std::uint8_t*>& ScanResults) {
+            std::uint8_t* CurrentResolutionScanResult = ScanResults[0];
+            if (CurrentResolutionScanResult) {
+                spdlog::info("Current Resolution: Address is {:s}+{:x}", sExeName.c_str(), CurrentResolutionScanResult - (std::uint8_t*)exeModule);
+                static SafetyHookMid CurrentResolutionMidHook{};
+                CurrentResolutionMidHook = safetyhook::create_mid(CurrentResolutionScanResult,
+                    [](SafetyHookContext& ctx) {
+                        // Get current resolution
+                        int iResX = (int)ctx.rdx;
+                        int iResY = (int)ctx.r8;
+
+                        const DisplayState& state = GetDisplayState();
+                        if (iResX != state.iResX || iResY != state.iResY) {
+                            // Publish new display state and log resolution
+                            // The bumped generation triggers a HUD resize
+                            CalculateAspectRatio(iResX, iResY, true);
+                            UpdateHUDFixes(GetDisplayState());
+                        }
+                    });
+            }
+            else {
+                spdlog::error("Current Resolution: Pattern scan failed.");
+            }
+        });
 }
 
 void Resolution()
@@ -228,61 +353,73 @@ void Resolution()
         }
 
         // Resolution list
-        std::uint8_t* ResolutionListScanResult = Memory::PatternScan(exeModule, "C0 03 00 00 1C 02 00 00 00 04 00 00 40 02 00 00");
-        if (ResolutionListScanResult) {
-            spdlog::info("Resolution List: Address is {:s}+{:x}", sExeName.c_str(), ResolutionListScanResult - (std::uint8_t*)exeModule);
-
-            // Overwrite 3840x2160
-            Memory::Write(ResolutionListScanResult + 0x38, iCustomResX);
-            Memory::Write(ResolutionListScanResult + 0x3C, iCustomResY);
-            spdlog::info("Resolution List: Replaced 3840x2160 with {}x{}.", iCustomResX, iCustomResY);
-        }
-        else {
-            spdlog::error("Resolution List: Pattern scan failed.");
-        } 
+        RegisterScan(StartupScans, "Resolution List", 50, 5000ms, { "C0 03 00 00 1C 02 00 00 00 04 00 00 40 02 00 00" },
+            [](const std::vector<std::uint8_t*>& ScanResults) {
+                std::uint8_t* ResolutionListScanResult = ScanResults[0];
+                if (ResolutionListScanResult) {
+                    spdlog::info("Resolution List: Address is {:s}+{:x}", sExeName.c_str(), ResolutionListScanResult - (std::uint8_t*)exeModule);
+
+                    // Overwrite 3840x2160
+                    Memory::Write(ResolutionListScanResult + 0x38, iCustomResX);
+                    Memory::Write(ResolutionListScanResult + 0x3C, iCustomResY);
+                    spdlog::info("Resolution List: Replaced 3840x2160 with {}x{}.", iCustomResX, iCustomResY);
+                }
+                else {
+                    spdlog::error("Resolution List: Pattern scan failed.");
+                } 
+            });
 
         // Resolution check
-        std::uint8_t* ResolutionListCheckScanResult = Memory::PatternScan(exeModule, "7C ?? 8B ?? 48 8B ?? ?? ?? 48 83 ?? ?? ?? C3 41 ?? ?? 48 8B ?? ?? ?? 48 83 ?? ?? ?? C3");
-        std::uint8_t* ResolutionSupportedCheckScanResult = Memory::PatternScan(exeModule, "7D ?? 49 ?? ?? 01 79 ?? 48 8B ?? ?? ?? 48 8B ?? ?? ?? 48 83 ?? ?? ?? C3");
-        if (ResolutionListCheckScanResult && ResolutionSupportedCheckScanResult) {
-            spdlog::info("Resolution Check: List: Address is {:s}+{:x}", sExeName.c_str(), ResolutionListCheckScanResult - (std::uint8_t*)exeModule);
-            Memory::PatchBytes(ResolutionListCheckScanResult, "\x90\x90", 2);
-
-            spdlog::info("Resolution Check: Supported: Address is {:s}+{:x}", sExeName.c_str(), ResolutionSupportedCheckScanResult - (std::uint8_t*)exeModule);
-            Memory::PatchBytes(ResolutionSupportedCheckScanResult, "\x90\x90", 2);
-        }
-        else {
-            spdlog::error("Resolution Check: Pattern scan(s) failed.");
-        }
+        RegisterScan(StartupScans, "Resolution Check", 50, 5000ms, {
+                "7C ?? 8B ?? 48 8B ?? ?? ?? 48 83 ?? ?? ?? C3 41 ?? ?? 48 8B ?? ?? ?? 48 83 ?? ?? ?? C3",
+                "7D ?? 49 ?? ?? 01 79 ?? 48 8B ?? ?? ?? 48 8B ?? ?? ?? 48 83 ?? ?? ?? C3"
+            },
+            [](const std::vector<std::uint8_t*>& ScanResults) {
+                std::uint8_t* ResolutionListCheckScanResult = ScanResults[0];
+                std::uint8_t* ResolutionSupportedCheckScanResult = ScanResults[1];
+                if (ResolutionListCheckScanResult && ResolutionSupportedCheckScanResult) {
+                    spdlog::info("Resolution Check: List: Address is {:s}+{:x}", sExeName.c_str(), ResolutionListCheckScanResult - (std::uint8_t*)exeModule);
+                    Memory::PatchBytes(ResolutionListCheckScanResult, "\x90\x90", 2);
+
+                    spdlog::info("Resolution Check: Supported: Address is {:s}+{:x}", sExeName.c_str(), ResolutionSupportedCheckScanResult - (std::uint8_t*)exeModule);
+                    Memory::PatchBytes(ResolutionSupportedCheckScanResult, "\x90\x90", 2);
+                }
+                else {
+                    spdlog::error("Resolution Check: Pattern scan(s) failed.");
+                }
+            });
 
         // Resolution string
-        std::uint8_t* ResolutionStringScanResult = Memory::PatternScan(exeModule, "48 85 ?? 74 ?? 48 83 ?? ?? ?? 72 ?? 48 8B ?? 48 83 ?? ?? 5B C3");
-        if (ResolutionStringScanResult) {
-            static bool bStringIdentified = false;
-
-            spdlog::info("Resolution String: Address is {:s}+{:x}", sExeName.c_str(), ResolutionStringScanResult - (std::uint8_t*)exeModule);
-            static SafetyHookMid ResolutionStringMidHook{};
-            ResolutionStringMidHook = safetyhook::create_mid(ResolutionStringScanResult,
-                [](SafetyHookContext& ctx) {
-                    // This is pretty inefficient but ¯\_(ツ)_/¯
-                    if (!bStringIdentified && ctx.rax) {
-                        const std::string oldRes = "3840x2160";
-                        std::string newRes = std::to_string(iCustomResX) + "x" + std::to_string(iCustomResY);
-
-                        char* currentString = (char*)ctx.rax;
-                        if (strncmp(currentString, oldRes.c_str(), oldRes.size()) == 0) {
-                            if (newRes.size() <= oldRes.size()) {
-                                std::memcpy(currentString, newRes.c_str(), newRes.size() + 1);
-                                spdlog::info("Resolution String: Replaced 3840x2160 with {}", newRes);
+        RegisterScan(StartupScans, "Resolution String", 50, 5000ms, { "48 85 ?? 74 ?? 48 83 ?? ?? ?? 72 ?? 48 8B ?? 48 83 ?? ?? 5B C3" },
+            [](const std::vector<std::uint8_t*>& ScanResults) {
+                std::uint8_t* ResolutionStringScanResult = ScanResults[0];
+                if (ResolutionStringScanResult) {
+                    static bool bStringIdentified = false;
+
+                    spdlog::info("Resolution String: Address is {:s}+{:x}", sExeName.c_str(), ResolutionStringScanResult - (std::uint8_t*)exeModule);
+                    static SafetyHookMid ResolutionStringMidHook{};
+                    ResolutionStringMidHook = safetyhook::create_mid(ResolutionStringScanResult,
+                        [](SafetyHookContext& ctx) {
+                            // This is pretty inefficient but ¯\_(ツ)_/¯
+                            if (!bStringIdentified && ctx.rax) {
+                                const std::string oldRes = "3840x2160";
+                                std::string newRes = std::to_string(iCustomResX) + "x" + std::to_string(iCustomResY);
+
+                                char* currentString = (char*)ctx.rax;
+                                if (strncmp(currentString, oldRes.c_str(), oldRes.size()) == 0) {
+                                    if (newRes.size() <= oldRes.size()) {
+                                        std::memcpy(currentString, newRes.c_str(), newRes.size() + 1);
+                                        spdlog::info("Resolution String: Replaced 3840x2160 with {}", newRes);
+                                    }
+                                    bStringIdentified = true; // Stop string comparisons if we've already seen/modified "3840x2160"
+                                }
                             }
-                            bStringIdentified = true; // Stop string comparisons if we've already seen/modified "3840x2160"
-                        }
-                    }
-                });
-        }
-        else {
-            spdlog::error("Resolution String: Pattern scan failed.");
-        }
+                        });
+                }
+                else {
+                    spdlog::error("Resolution String: Pattern scan failed.");
+                }
+            });
     } 
 }
 
@@ -291,42 +428,49 @@ void IntroSkip()
     if (bIntroSkip)
     {
         // Skip logos/autosave dialog/attract movie
-        std::uint8_t* IntroLogosScanResult = Memory::PatternScan(exeModule, "48 ?? ?? 83 ?? 02 76 ?? C6 ?? ?? ?? ?? ?? 01 33 ?? 48 83 ?? ??");
-        std::uint8_t* AutosaveDialogScanResult = Memory::PatternScan(exeModule, "84 ?? 0F 84 ?? ?? ?? ?? 83 ?? ?? ?? ?? ?? 00 74 ?? 83 ?? ?? ?? ?? ?? 00 74 ?? 48 8B ?? ?? ?? ?? ??");
-        std::uint8_t* AttractMovieScanResult = Memory::PatternScan(exeModule, "33 ?? 84 ?? 75 ?? E8 ?? ?? ?? ?? 4C 8D ?? ?? ?? 48 89 ?? ?? ?? 41 ?? ?? ?? ?? ?? 48 89 ?? ?? ??");
-        if (IntroLogosScanResult && AutosaveDialogScanResult && AttractMovieScanResult) {
-            spdlog::info("Intro Skip: Logos: Address is {:s}+{:x}", sExeName.c_str(), IntroLogosScanResult - (std::uint8_t*)exeModule);
-            static SafetyHookMid IntroLogosMidHook{};
-            IntroLogosMidHook = safetyhook::create_mid(IntroLogosScanResult,
-                [](SafetyHookContext& ctx) {
-                    if (!bHasSkippedIntro) {
-                        ctx.rax = (ctx.rax & ~0xFF) | 0x03;
-                    }
-                });
-
-            spdlog::info("Intro Skip: Autosave Dialog: Address is {:s}+{:x}", sExeName.c_str(), AutosaveDialogScanResult - (std::uint8_t*)exeModule);
-            static SafetyHookMid AutosaveDialogMidHook{};
-            AutosaveDialogMidHook = safetyhook::create_mid(AutosaveDialogScanResult,
-                [](SafetyHookContext& ctx) {
-                    // This one causes a glitch in the OOBE for the demo where the autosave dialog remains visual.
-                    if (!bHasSkippedIntro) {
-                        ctx.rax = (ctx.rax & ~0xFF) | 0x01;
-                    }
-                });
-
-            spdlog::info("Intro Skip: Attract Movie: Address is {:s}+{:x}", sExeName.c_str(), AttractMovieScanResult - (std::uint8_t*)exeModule);
-            static SafetyHookMid AttractMovieMidHook{};
-            AttractMovieMidHook = safetyhook::create_mid(AttractMovieScanResult,
-                [](SafetyHookContext& ctx) {
-                    if (!bHasSkippedIntro) {
-                        ctx.rax = (ctx.rax & ~0xFF) | 0x01;
-                        bHasSkippedIntro = true;
-                    }
-                });
-        }
-        else {
-            spdlog::error("Intro Skip: Pattern scan(s) failed.");
-        }
+        RegisterScan(StartupScans, "Intro Skip", 90, 1000ms, {
+                "48 ?? ?? 83 ?? 02 76 ?? C6 ?? ?? ?? ?? ?? 01 33 ?? 48 83 ?? ??",
+                "84 ?? 0F 84 ?? ?? ?? ?? 83 ?? ?? ?? ?? ?? 00 74 ?? 83 ?? ?? ?? ?? ?? 00 74 ?? 48 8B ?? ?? ?? ?? ??",
+                "33 ?? 84 ?? 75 ?? E8 ?? ?? ?? ?? 4C 8D ?? ?? ?? 48 89 ?? ?? ?? 41 ?? ?? ?? ?? ?? 48 89 ?? ?? ??"
+            },
+            [](const std::vector<std::uint8_t*>& ScanResults) {
+                std::uint8_t* IntroLogosScanResult = ScanResults[0];
+                std::uint8_t* AutosaveDialogScanResult = ScanResults[1];
+                std::uint8_t* AttractMovieScanResult = ScanResults[2];
+                if (IntroLogosScanResult && AutosaveDialogScanResult && AttractMovieScanResult) {
+                    spdlog::info("Intro Skip: Logos: Address is {:s}+{:x}", sExeName.c_str(), IntroLogosScanResult - (std::uint8_t*)exeModule);
+                    static SafetyHookMid IntroLogosMidHook{};
+                    IntroLogosMidHook = safetyhook::create_mid(IntroLogosScanResult,
+                        [](SafetyHookContext& ctx) {
+                            if (!bHasSkippedIntro) {
+                                ctx.rax = (ctx.rax & ~0xFF) | 0x03;
+                            }
+                        });
+
+                    spdlog::info("Intro Skip: Autosave Dialog: Address is {:s}+{:x}", sExeName.c_str(), AutosaveDialogScanResult - (std::uint8_t*)exeModule);
+                    static SafetyHookMid AutosaveDialogMidHook{};
+                    AutosaveDialogMidHook = safetyhook::create_mid(AutosaveDialogScanResult,
+                        [](SafetyHookContext& ctx) {
+                            // This one causes a glitch in the OOBE for the demo where the autosave dialog remains visual.
+                            if (!bHasSkippedIntro) {
+                                ctx.rax = (ctx.rax & ~0xFF) | 0x01;
+                            }
+                        });
+
+                    spdlog::info("Intro Skip: Attract Movie: Address is {:s}+{:x}", sExeName.c_str(), AttractMovieScanResult - (std::uint8_t*)exeModule);
+                    static SafetyHookMid AttractMovieMidHook{};
+                    AttractMovieMidHook = safetyhook::create_mid(AttractMovieScanResult,
+                        [](SafetyHookContext& ctx) {
+                            if (!bHasSkippedIntro) {
+                                ctx.rax = (ctx.rax & ~0xFF) | 0x01;
+                                bHasSkippedIntro = true;
+                            }
+                        });
+                }
+                else {
+                    spdlog::error("Intro Skip: Pattern scan(s) failed.");
+                }
+            });
     }
 }
 
@@ -335,176 +479,250 @@ void FOV()
     if (fGameplayFOVMulti != 1.00f)
     {
         // Gameplay FOV
-        std::uint8_t* GameplayFOVScanResult = Memory::PatternScan(exeModule, "E8 ?? ?? ?? ?? 0F ?? ?? 48 8B ?? FF ?? 48 8B ?? 48 8B ?? ?? 48 8B ?? ?? ?? ?? ?? E8 ?? ?? ?? ??");
-        if (GameplayFOVScanResult) {
-            spdlog::info("FOV: Gameplay: Address is {:s}+{:x}", sExeName.c_str(), GameplayFOVScanResult - (std::uint8_t*)exeModule);
-            static SafetyHookMid GameplayFOVMidHook{};
-            GameplayFOVMidHook = safetyhook::create_mid(GameplayFOVScanResult + 0x5,
-                [](SafetyHookContext& ctx) {
-                    ctx.xmm0.f32[0] *= fGameplayFOVMulti;
-                });
-        }
-        else {
-            spdlog::error("FOV: Gameplay: Pattern scan failed.");
-        }
+        RegisterScan(StartupScans, "FOV: Gameplay", 30, 10000ms, { "E8 ?? ?? ?? ?? 0F ?? ?? 48 8B ?? FF ?? 48 8B ?? 48 8B ?? ?? 48 8B ?? ?? ?? ?? ?? E8 ?? ?? ?? ??" },
+            [](const std::vector<std::uint8_t*>& ScanResults) {
+                std::uint8_t* GameplayFOVScanResult = ScanResults[0];
+                if (GameplayFOVScanResult) {
+                    spdlog::info("FOV: Gameplay: Address is {:s}+{:x}", sExeName.c_str(), GameplayFOVScanResult - (std::uint8_t*)exeModule);
+                    static SafetyHookMid GameplayFOVMidHook{};
+                    GameplayFOVMidHook = safetyhook::create_mid(GameplayFOVScanResult + 0x5,
+                        [](SafetyHookContext& ctx) {
+                            ctx.xmm0.f32[0] *= fGameplayFOVMulti;
+                        });
+                }
+                else {
+                    spdlog::error("FOV: Gameplay: Pattern scan failed.");
+                }
+            });
     }
 
     if (fBattleFOVMulti != 1.00f)
     {
         // Battle FOV
-        std::uint8_t* BattleFOVScanResult = Memory::PatternScan(exeModule, "48 8B ?? F3 44 ?? ?? ?? ?? ?? F3 44 ?? ?? ?? ?? ?? FF ?? ?? 84 ?? 74 ??");
-        if (BattleFOVScanResult) {
-            spdlog::info("FOV: Battle: Address is {:s}+{:x}", sExeName.c_str(), BattleFOVScanResult - (std::uint8_t*)exeModule);
-            static SafetyHookMid BattleFOVMidHook{};
-            BattleFOVMidHook = safetyhook::create_mid(BattleFOVScanResult,
-                [](SafetyHookContext& ctx) {
-                    ctx.xmm9.f32[0] *= fBattleFOVMulti;
-                });
-        }
-        else {
-            spdlog::error("FOV: Battle: Pattern scan failed.");
-        }
+        RegisterScan(StartupScans, "FOV: Battle", 30, 10000ms, { "48 8B ?? F3 44 ?? ?? ?? ?? ?? F3 44 ?? ?? ?? ?? ?? FF ?? ?? 84 ?? 74 ??" },
+            [](const std::vector<std::uint8_t*>& ScanResults) {
+                std::uint8_t* BattleFOVScanResult = ScanResults[0];
+                if (BattleFOVScanResult) {
+                    spdlog::info("FOV: Battle: Address is {:s}+{:x}", sExeName.c_str(), BattleFOVScanResult - (std::uint8_t*)exeModule);
+                    static SafetyHookMid BattleFOVMidHook{};
+                    BattleFOVMidHook = safetyhook::create_mid(BattleFOVScanResult,
+                        [](SafetyHookContext& ctx) {
+                            ctx.xmm9.f32[0] *= fBattleFOVMulti;
+                        });
+                }
+                else {
+                    spdlog::error("FOV: Battle: Pattern scan failed.");
+                }
+            });
     }
    
 }
 
+void PhotoModeBlur()
+{
+    if (bFixHUD)
+    {
+        // Photo mode blur
+        // Not part of the lazy HUD fixes since it forces 1920x1080 at every aspect ratio, including 16:9
+        RegisterScan(StartupScans, "HUD: Photo Mode Blur", 10, 10000ms, { "48 89 ?? ?? ?? ?? ?? ?? 8B ?? ?? ?? ?? ?? 48 89 ?? ?? ?? 48 8D ?? ?? ?? ?? ?? ?? 89 ?? ?? ?? ?? ?? ?? 48 8D ?? ?? ?? ?? ?? 48 89 ?? ?? ??" },
+            [](const std::vector<std::uint8_t*>& ScanResults) {
+                std::uint8_t* PhotoModeBlurScanResult = ScanResults[0];
+                if (PhotoModeBlurScanResult) { 
+                    spdlog::info("HUD: Photo Mode Blur: Address is {:s}+{:x}", sExeName.c_str(), PhotoModeBlurScanResult - (std::uint8_t*)exeModule);
+                    static SafetyHookMid PhotoModeBlurMidHook{};
+                    PhotoModeBlurMidHook = safetyhook::create_mid(PhotoModeBlurScanResult,
+                        [](SafetyHookContext& ctx) {
+                            const DisplayState& state = GetDisplayState();
+                            ctx.rcx = (static_cast<uintptr_t>(1080) << 32) | 1920;
+
+                            if (ctx.rbx) {
+                                if (state.fAspectRatio > fNativeAspect)
+                                    *reinterpret_cast<short*>(ctx.rbx + 0xF0) = static_cast<short>(std::ceilf(1080.00f * state.fAspectRatio));
+                                else if (state.fAspectRatio < fNativeAspect)
+                                    *reinterpret_cast<short*>(ctx.rbx + 0xF2) = static_cast<short>(std::ceilf(1920.00f / state.fAspectRatio));
+                            }
+                        });
+                }
+                else {
+                    spdlog::error("HUD: Photo Mode Blur: Pattern scan failed.");
+                }
+            });
+    }
+}
+
 void HUD()
 {
     if (bFixHUD) 
     {             
         // HUD Size
-        std::uint8_t* HUDSizeScanResult = Memory::PatternScan(exeModule, "4C ?? ?? ?? ?? ?? ?? 49 ?? ?? ?? ?? ?? ?? 4B ?? ?? ?? 83 ?? ?? 72 ?? 49 ?? ??");
-        if (HUDSizeScanResult) {
-            spdlog::info("HUD: Size: Address is {:s}+{:x}", sExeName.c_str(), HUDSizeScanResult - (std::uint8_t*)exeModule);
-            static SafetyHookMid HUDSizeMidHook{};
-            HUDSizeMidHook = safetyhook::create_mid(HUDSizeScanResult,
-                [](SafetyHookContext& ctx) {
-                    if (ctx.r9 && bHUDNeedsResize) {                                          
-                        if (fAspectRatio > fNativeAspect) {
-                            *reinterpret_cast<float*>(ctx.r9 + 0x4A0) = fHUDFOV / fAspectRatio;
-                            *reinterpret_cast<float*>(ctx.r9 + 0x4B4) = fHUDFOV;
-
-                            *reinterpret_cast<int*>(ctx.r9 + 0x690) = static_cast<int>(std::ceilf(1080.00f * fAspectRatio));
-                            *reinterpret_cast<int*>(ctx.r9 + 0x694) = 1080;
-
-                            *reinterpret_cast<float*>(ctx.r9 + 0x7B0) = 2.00f / (1080.00f * fAspectRatio);
-                            *reinterpret_cast<float*>(ctx.r9 + 0x7C4) = 2.00f / 1080.00f;
-                        }
-                        else if (fAspectRatio < fNativeAspect) {
-                            *reinterpret_cast<float*>(ctx.r9 + 0x4A0) = fHUDFOV / fNativeAspect;
-                            *reinterpret_cast<float*>(ctx.r9 + 0x4B4) = fHUDFOV / fAspectRatio;
+        RegisterScan(HUDScans, "HUD: Size", 10, 10000ms, { "4C ?? ?? ?? ?? ?? ?? 49 ?? ?? ?? ?? ?? ?? 4B ?? ?? ?? 83 ?? ?? 72 ?? 49 ?? ??" },
+            [](const std::vector<std::uint8_t*>& ScanResults) {
+                std::uint8_t* HUDSizeScanResult = ScanResults[0];
+                if (HUDSizeScanResult) {
+                    spdlog::info("HUD: Size: Address is {:s}+{:x}", sExeName.c_str(), HUDSizeScanResult - (std::uint8_t*)exeModule);
+                    HUDSizeMidHook = safetyhook::create_mid(HUDSizeScanResult,
+                        [](SafetyHookContext& ctx) {
+                            const DisplayState& state = GetDisplayState();
+                            if (ctx.r9 && iHUDResizedGeneration.load(std::memory_order_relaxed) != state.iGeneration) {
+                                if (state.fAspectRatio > fNativeAspect) {
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x4A0) = fHUDFOV / state.fAspectRatio;
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x4B4) = fHUDFOV;
+
+                                    *reinterpret_cast<int*>(ctx.r9 + 0x690) = static_cast<int>(std::ceilf(1080.00f * state.fAspectRatio));
+                                    *reinterpret_cast<int*>(ctx.r9 + 0x694) = 1080;
+
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x7B0) = 2.00f / (1080.00f * state.fAspectRatio);
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x7C4) = 2.00f / 1080.00f;
+                                }
+                                else if (state.fAspectRatio < fNativeAspect) {
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x4A0) = fHUDFOV / fNativeAspect;
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x4B4) = fHUDFOV / state.fAspectRatio;
+
+                                    *reinterpret_cast<int*>(ctx.r9 + 0x690) = 1920;
+                                    *reinterpret_cast<int*>(ctx.r9 + 0x694) = static_cast<int>(std::ceilf(1920.00f / state.fAspectRatio));
+
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x7B0) = 2.00f / 1920.00f;
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x7C4) = 2.00f / (1920.00f / state.fAspectRatio);
+                                }
+                                else { // Defaults
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x4A0) = fHUDFOV / fNativeAspect;
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x4B4) = fHUDFOV;
+
+                                    *reinterpret_cast<int*>(ctx.r9 + 0x690) = 1920;
+                                    *reinterpret_cast<int*>(ctx.r9 + 0x694) = 1080;
+
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x7B0) = 2.00f / 1920.00f;
+                                    *reinterpret_cast<float*>(ctx.r9 + 0x7C4) = 2.00f / 1080.00f;
+                                }
+
+                                // HUD resize is over for this generation
+                                iHUDResizedGeneration.store(state.iGeneration, std::memory_order_relaxed);
+                            }
+                        });
+                }
+                else {
+                    spdlog::error("HUD: Size: Pattern scan failed.");
+                }
+            });
 
-                            *reinterpret_cast<int*>(ctx.r9 + 0x690) = 1920;
-                            *reinterpret_cast<int*>(ctx.r9 + 0x694) = static_cast<int>(std::ceilf(1920.00f / fAspectRatio));
+       
+        // HUD Objects
+        RegisterScan(HUDScans, "HUD: Objects", 10, 10000ms, { "89 ?? ?? 49 8B ?? ?? 48 8B ?? FF 90 ?? ?? ?? ?? 8B ?? 33 ?? 49 8B ?? ??" },
+            [](const std::vector<std::uint8_t*>& ScanResults) {
+                std::uint8_t* HUDObjectsScanResult = ScanResults[0];
+                if (HUDObjectsScanResult) { 
+                    spdlog::info("HUD: Objects: Address is {:s}+{:x}", sExeName.c_str(), HUDObjectsScanResult - (std::uint8_t*)exeModule);
+                    HUDObjectsMidHook = safetyhook::create_mid(HUDObjectsScanResult,
+                        [](SafetyHookContext& ctx) {
+                            if (!ctx.r13)
+                                return;
+
+                            const DisplayState& state = GetDisplayState();
+
+                            std::uint8_t* pHUDObject = *reinterpret_cast<std::uint8_t**>(ctx.r13 + 0x08);
+                            int iHUDObjectX = *reinterpret_cast<short*>(pHUDObject + 0xF0);
+                            int iHUDObjectY = *reinterpret_cast<short*>(pHUDObject + 0xF2);
+
+                            // Skip already scaled 1920x1080 objects
+                            if (state.fAspectRatio > fNativeAspect) {
+                                if (iHUDObjectX == static_cast<short>(std::ceilf(1080.00f * state.fAspectRatio)) && iHUDObjectY == 1080)
+                                    return;
+                            }
+                            else if (state.fAspectRatio < fNativeAspect) {
+                                if (iHUDObjectX == 1920 && iHUDObjectY == static_cast<short>(std::ceilf(1920.00f / state.fAspectRatio)))
+                                    return;
+                            }
 
-                            *reinterpret_cast<float*>(ctx.r9 + 0x7B0) = 2.00f / 1920.00f;
-                            *reinterpret_cast<float*>(ctx.r9 + 0x7C4) = 2.00f / (1920.00f / fAspectRatio);
-                        }
-                        else { // Defaults
-                            *reinterpret_cast<float*>(ctx.r9 + 0x4A0) = fHUDFOV / fNativeAspect;
-                            *reinterpret_cast<float*>(ctx.r9 + 0x4B4) = fHUDFOV;
+                            // Fix photo mode filters
+                            if (iHUDObjectX == 1920 && iHUDObjectY == 1080) {
+                                if (strncmp(reinterpret_cast<const char*>(ctx.r13 + 0x20), "sample", 6) == 0) {
+                                    if (state.fAspectRatio > fNativeAspect) {
+                                        *reinterpret_cast<short*>(pHUDObject + 0xF0) = static_cast<short>(std::ceilf(1080.00f * state.fAspectRatio));
+                                        ctx.rax = (static_cast<uintptr_t>(iHUDObjectY) << 16) | static_cast<short>(ceilf(iHUDObjectX * state.fAspectMultiplier));
+                                    }
+                                    else if (state.fAspectRatio < fNativeAspect) {
+                                        *reinterpret_cast<short*>(pHUDObject + 0xF2) = static_cast<short>(std::ceilf(1920.00f / state.fAspectRatio));
+                                        ctx.rax = (static_cast<uintptr_t>(static_cast<short>(ceilf(iHUDObjectX / state.fAspectRatio))) << 16) | iHUDObjectX;
+                                    }
+                                    return;
+                                }
+                            }
 
-                            *reinterpret_cast<int*>(ctx.r9 + 0x690) = 1920;
-                            *reinterpret_cast<int*>(ctx.r9 + 0x694) = 1080;
+                            // Backgrounds
+                            if ( (iHUDObjectX > 1921 && iHUDObjectY > 1081) || (iHUDObjectX > 1999 && iHUDObjectY > 1079) || (iHUDObjectX == 4000 && iHUDObjectY == 1000) ) {
+                                if (state.fAspectRatio > fNativeAspect)
+                                    ctx.rax = (static_cast<uintptr_t>(iHUDObjectY) << 16) | static_cast<short>(ceilf(iHUDObjectX * state.fAspectMultiplier));
+                                else if (state.fAspectRatio < fNativeAspect)
+                                    ctx.rax = (static_cast<uintptr_t>(static_cast<short>(ceilf(iHUDObjectX / state.fAspectRatio))) << 16) | iHUDObjectX;
+                            }
+                        });
+                }
+                else {
+                    spdlog::error("HUD: Objects: Pattern scan failed.");
+                }
+            });
 
-                            *reinterpret_cast<float*>(ctx.r9 + 0x7B0) = 2.00f / 1920.00f;
-                            *reinterpret_cast<float*>(ctx.r9 + 0x7C4) = 2.00f / 1080.00f;
-                        }
+        // Fix culling of in-world markers
+        RegisterScan(HUDScans, "HUD: Markers", 10, 10000ms, { "72 ?? 0F ?? ?? 72 ?? 48 8D ?? ?? ?? E8 ?? ?? ?? ?? 0F ?? ?? ?? ?? ?? ?? 72 ?? 0F ?? ?? 72 ?? B0 01" },
+            [](const std::vector<std::uint8_t*>& ScanResults) {
+                std::uint8_t* MarkersCullingScanResult = ScanResults[0];
+                if (MarkersCullingScanResult) {
+                    spdlog::info("HUD: Markers: Address is {:s}+{:x}", sExeName.c_str(), MarkersCullingScanResult - (std::uint8_t*)exeModule);
+                    std::memcpy(MarkersCullingOriginalBytes, MarkersCullingScanResult, sizeof(MarkersCullingOriginalBytes));
+                    MarkersCullingAddress = MarkersCullingScanResult;
+                    Memory::PatchBytes(MarkersCullingScanResult, "\xEB\x1D", 2); // Don't cull any of them
+                    spdlog::info("HUD: Markers: Patched instruction.");
+                }
+                else {
+                    spdlog::error("HUD: Markers: Pattern scan failed.");
+                }
+            });
+    }
+}
 
-                        // HUD resize is over
-                        bHUDNeedsResize = false; 
-                    }
-                });
-        }
-        else {
-            spdlog::error("HUD: Size: Pattern scan failed.");
-        }
+void SetHUDFixesEnabled(bool bEnabled)
+{
+    // HUD Size stays enabled so it can put the HUD back to its default size after switching to 16:9
+    if (HUDObjectsMidHook) {
+        if (bEnabled)
+            (void)HUDObjectsMidHook.enable();
+        else
+            (void)HUDObjectsMidHook.disable();
+    }
 
-       
-        // Photo mode blur
-        std::uint8_t* PhotoModeBlurScanResult = Memory::PatternScan(exeModule, "48 89 ?? ?? ?? ?? ?? ?? 8B ?? ?? ?? ?? ?? 48 89 ?? ?? ?? 48 8D ?? ?? ?? ?? ?? ?? 89 ?? ?? ?? ?? ?? ?? 48 8D ?? ?? ?? ?? ?? 48 89 ?? ?? ??");
-        if (PhotoModeBlurScanResult) { 
-            spdlog::info("HUD: Photo Mode Blur: Address is {:s}+{:x}", sExeName.c_str(), PhotoModeBlurScanResult - (std::uint8_t*)exeModule);
-            static SafetyHookMid PhotoModeBlurMidHook{};
-            PhotoModeBlurMidHook = safetyhook::create_mid(PhotoModeBlurScanResult,
-                [](SafetyHookContext& ctx) {
-                    ctx.rcx = (static_cast<uintptr_t>(1080) << 32) | 1920;
-
-                    if (ctx.rbx) {
-                        if (fAspectRatio > fNativeAspect)
-                            *reinterpret_cast<short*>(ctx.rbx + 0xF0) = static_cast<short>(std::ceilf(1080.00f * fAspectRatio));
-                        else if (fAspectRatio < fNativeAspect)
-                            *reinterpret_cast<short*>(ctx.rbx + 0xF2) = static_cast<short>(std::ceilf(1920.00f / fAspectRatio));
-                    }
-                });
-        }
-        else {
-            spdlog::error("HUD: Photo Mode Blur: Pattern scan failed.");
-        }
+    if (MarkersCullingAddress)
+        Memory::PatchBytes(MarkersCullingAddress, bEnabled ? "\xEB\x1D" : MarkersCullingOriginalBytes, 2);
 
-        // HUD Objects
-        std::uint8_t* HUDObjectsScanResult = Memory::PatternScan(exeModule, "89 ?? ?? 49 8B ?? ?? 48 8B ?? FF 90 ?? ?? ?? ?? 8B ?? 33 ?? 49 8B ?? ??");
-        if (HUDObjectsScanResult) { 
-            spdlog::info("HUD: Objects: Address is {:s}+{:x}", sExeName.c_str(), HUDObjectsScanResult - (std::uint8_t*)exeModule);
-            static SafetyHookMid HUDObjectsMidHook{};
-            HUDObjectsMidHook = safetyhook::create_mid(HUDObjectsScanResult,
-                [](SafetyHookContext& ctx) {
-                    if (!ctx.r13)
-                        return;
-
-                    pHUDObject = *reinterpret_cast<std::uint8_t**>(ctx.r13 + 0x08);
-                    iHUDObjectX = *reinterpret_cast<short*>(pHUDObject + 0xF0);
-                    iHUDObjectY = *reinterpret_cast<short*>(pHUDObject + 0xF2);
-
-                    // Skip already scaled 1920x1080 objects
-                    if (fAspectRatio > fNativeAspect) {
-                        if (iHUDObjectX == static_cast<short>(std::ceilf(1080.00f * fAspectRatio)) && iHUDObjectY == 1080)
-                            return;
-                    }
-                    else if (fAspectRatio < fNativeAspect) {
-                        if (iHUDObjectX == 1920 && iHUDObjectY == static_cast<short>(std::ceilf(1920.00f / fAspectRatio)))
-                            return;
-                    }
-
-                    // Fix photo mode filters
-                    if (iHUDObjectX == 1920 && iHUDObjectY == 1080) {
-                        if (strncmp(reinterpret_cast<const char*>(ctx.r13 + 0x20), "sample", 6) == 0) {
-                            if (fAspectRatio > fNativeAspect) {
-                                *reinterpret_cast<short*>(pHUDObject + 0xF0) = static_cast<short>(std::ceilf(1080.00f * fAspectRatio));
-                                ctx.rax = (static_cast<uintptr_t>(iHUDObjectY) << 16) | static_cast<short>(ceilf(iHUDObjectX * fAspectMultiplier));
-                            }
-                            else if (fAspectRatio < fNativeAspect) {
-                                *reinterpret_cast<short*>(pHUDObject + 0xF2) = static_cast<short>(std::ceilf(1920.00f / fAspectRatio));
-                                ctx.rax = (static_cast<uintptr_t>(static_cast<short>(ceilf(iHUDObjectX / fAspectRatio))) << 16) | iHUDObjectX;
-                            }
-                            return;
-                        }
-                    }
-
-                    // Backgrounds
-                    if ( (iHUDObjectX > 1921 && iHUDObjectY > 1081) || (iHUDObjectX > 1999 && iHUDObjectY > 1079) || (iHUDObjectX == 4000 && iHUDObjectY == 1000) ) {
-                        if (fAspectRatio > fNativeAspect)
-                            ctx.rax = (static_cast<uintptr_t>(iHUDObjectY) << 16) | static_cast<short>(ceilf(iHUDObjectX * fAspectMultiplier));
-                        else if (fAspectRatio < fNativeAspect)
-                            ctx.rax = (static_cast<uintptr_t>(static_cast<short>(ceilf(iHUDObjectX / fAspectRatio))) << 16) | iHUDObjectX;
-                    }
-                });
-        }
-        else {
-            spdlog::error("HUD: Objects: Pattern scan failed.");
-        }
+    spdlog::info("HUD: {:s} fixes for current aspect ratio.", bEnabled ? "Enabled" : "Disabled");
+}
 
-        // Fix culling of in-world markers
-        std::uint8_t* MarkersCullingScanResult = Memory::PatternScan(exeModule, "72 ?? 0F ?? ?? 72 ?? 48 8D ?? ?? ?? E8 ?? ?? ?? ?? 0F ?? ?? ?? ?? ?? ?? 72 ?? 0F ?? ?? 72 ?? B0 01");
-        if (MarkersCullingScanResult) {
-            spdlog::info("HUD: Markers: Address is {:s}+{:x}", sExeName.c_str(), MarkersCullingScanResult - (std::uint8_t*)exeModule);
-            Memory::PatchBytes(MarkersCullingScanResult, "\xEB\x1D", 2); // Don't cull any of them
-            spdlog::info("HUD: Markers: Patched instruction.");
-        }
-        else {
-            spdlog::error("HUD: Markers: Pattern scan failed.");
-        }
+void HUDActivation()
+{
+    // Serialised so back-to-back resolution changes are applied in order
+    std::scoped_lock lock(HUDActivationMutex);
+
+    if (!bHUDFixesInstalled) {
+        HUD();
+        RunScans(HUDScans);
+        bHUDFixesInstalled = true;
     }
+
+    // Apply whatever the latest resolution needs, not the one that started this worker
+    SetHUDFixesEnabled(bHUDFixesWanted.load());
+}
+
+void UpdateHUDFixes(const DisplayState& state)
+{
+    if (!bFixHUD)
+        return;
+
+    // Nothing is scanned or hooked until the first resolution that isn't 16:9
+    bool bWanted = state.fAspectRatio != fNativeAspect;
+    if (bHUDFixesWanted.exchange(bWanted) == bWanted)
+        return;
+
+    // Called from a game thread, so scanning and (un)hooking happens on a worker
+    std::thread(HUDActivation).detach();
 }
 
 DWORD __stdcall Main(void*)
@@ -515,7 +733,8 @@ DWORD __stdcall Main(void*)
     Resolution();
     IntroSkip();
     FOV();
-    HUD();
+    PhotoModeBlur();
+    RunScans(StartupScans);
 
     return true;
 }
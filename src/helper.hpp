@@ -121,6 +121,153 @@ namespace Memory
         return results;
     }
 
+    // MSVC x64 RTTI structures (offsets are image-relative)
+    struct RTTICompleteObjectLocator
+    {
+        DWORD signature;
+        DWORD offset;
+        DWORD cdOffset;
+        DWORD pTypeDescriptor;
+        DWORD pClassDescriptor;
+        DWORD pSelf;
+    };
+
+    struct RTTITypeDescriptor
+    {
+        void* pVFTable;
+        void* spare;
+        char name[1];
+    };
+
+    struct RTTIClass
+    {
+        std::uint8_t** vtable;
+        std::size_t methodCount;
+    };
+
+    struct RTTIIndex
+    {
+        // Demangled class name (i.e "Foo::Bar") -> primary vtable
+        std::unordered_map<std::string, RTTIClass> Classes;
+
+        std::uint8_t** FindVTable(const std::string& className) const
+        {
+            auto it = Classes.find(className);
+            return it != Classes.end() ? it->second.vtable : nullptr;
+        }
+
+        std::uint8_t* FindVirtualMethod(const std::string& className, std::size_t index) const
+        {
+            auto it = Classes.find(className);
+            if (it == Classes.end() || index >= it->second.methodCount)
+                return nullptr;
+            return it->second.vtable[index];
+        }
+    };
+
+    // ".?AVBar@Foo@@" -> "Foo::Bar". Templated names and names with back-references (i.e ".?AVns@1@@") are left mangled.
+    std::string DemangleTypeName(const char* mangledName)
+    {
+        std::string name = mangledName;
+        if (name.rfind(".?AV", 0) != 0 && name.rfind(".?AU", 0) != 0)
+            return name;
+        if (name.find("?$") != std::string::npos || name.size() < 6 || name.compare(name.size() - 2, 2, "@@") != 0)
+            return name;
+
+        name = name.substr(4, name.size() - 6);
+
+        // Identifiers can't start with a digit, so a digit after '@' (or at the start) is a back-reference
+        for (std::size_t i = 0; i < name.size(); ++i) {
+            if ((i == 0 || name[i - 1] == '@') && name[i] >= '0' && name[i] <= '9')
+                return mangledName;
+        }
+
+        std::string demangled;
+        std::size_t end = name.size();
+        while (true) {
+            std::size_t start = name.rfind('@', end - 1);
+            std::size_t partStart = (start == std::string::npos) ? 0 : start + 1;
+            if (!demangled.empty())
+                demangled += "::";
+            demangled += name.substr(partStart, end - partStart);
+            if (start == std::string::npos || start == 0)
+                break;
+            end = start;
+        }
+        return demangled;
+    }
+
+    // Indexes every complete object locator in the image and the vtable that references it.
+    // Two linear passes over the read-only data sections instead of one full-image pattern scan per class.
+    RTTIIndex BuildRTTIIndex(void* module)
+    {
+        auto base = reinterpret_cast<std::uint8_t*>(module);
+        auto dosHeader = (PIMAGE_DOS_HEADER)module;
+        auto ntHeaders = (PIMAGE_NT_HEADERS)(base + dosHeader->e_lfanew);
+        auto sizeOfImage = ntHeaders->OptionalHeader.SizeOfImage;
+
+        std::vector<std::pair<std::uint8_t*, std::uint8_t*>> codeSections;
+        std::vector<std::pair<std::uint8_t*, std::uint8_t*>> rdataSections;
+        auto section = IMAGE_FIRST_SECTION(ntHeaders);
+        for (WORD i = 0; i < ntHeaders->FileHeader.NumberOfSections; ++i, ++section) {
+            std::uint8_t* start = base + section->VirtualAddress;
+            std::uint8_t* end = start + section->Misc.VirtualSize;
+            if (section->Characteristics & IMAGE_SCN_MEM_EXECUTE)
+                codeSections.push_back({ start, end });
+            else if ((section->Characteristics & IMAGE_SCN_MEM_READ) && !(section->Characteristics & IMAGE_SCN_MEM_WRITE))
+                rdataSections.push_back({ start, end });
+        }
+
+        auto isCode = [&](std::uintptr_t address) {
+            for (const auto& [start, end] : codeSections) {
+                if (address >= (std::uintptr_t)start && address < (std::uintptr_t)end)
+                    return true;
+            }
+            return false;
+        };
+
+        // Complete object locators for primary vtables (offset 0), keyed by address
+        std::unordered_map<std::uintptr_t, const char*> locators;
+        for (const auto& [start, end] : rdataSections) {
+            for (std::uint8_t* p = start; p + sizeof(RTTICompleteObjectLocator) <= end; p += sizeof(DWORD)) {
+                auto col = reinterpret_cast<RTTICompleteObjectLocator*>(p);
+                if (col->signature != 1 || col->offset != 0 || col->pSelf != (DWORD)(p - base))
+                    continue;
+                if (col->pTypeDescriptor == 0 || col->pTypeDescriptor + sizeof(RTTITypeDescriptor) >= sizeOfImage)
+                    continue;
+
+                auto typeDescriptor = reinterpret_cast<RTTITypeDescriptor*>(base + col->pTypeDescriptor);
+                if (strncmp(typeDescriptor->name, ".?A", 3) != 0)
+                    continue;
+
+                locators.emplace((std::uintptr_t)p, typeDescriptor->name);
+            }
+        }
+
+        // A vtable is preceded by a pointer to its complete object locator
+        RTTIIndex index;
+        for (const auto& [start, end] : rdataSections) {
+            for (std::uint8_t* p = start; p + 2 * sizeof(std::uintptr_t) <= end; p += sizeof(std::uintptr_t)) {
+                auto it = locators.find(*reinterpret_cast<std::uintptr_t*>(p));
+                if (it == locators.end())
+                    continue;
+
+                auto vtable = reinterpret_cast<std::uint8_t**>(p + sizeof(std::uintptr_t));
+
+                // The table ends at the first slot that doesn't point to code (usually the next locator pointer)
+                std::size_t methodCount = 0;
+                while (reinterpret_cast<std::uint8_t*>(vtable + methodCount + 1) <= end && isCode((std::uintptr_t)vtable[methodCount]))
+                    ++methodCount;
+                if (methodCount == 0)
+                    continue;
+
+                index.Classes.emplace(DemangleTypeName(it->second), RTTIClass{ vtable, methodCount });
+            }
+        }
+
+        return index;
+    }
+
     std::uint32_t ModuleTimestamp(void* module)
     {
         auto dosHeader = (PIMAGE_DOS_HEADER)module;
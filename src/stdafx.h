@@ -6,4 +6,11 @@
 #include <cassert>
 #include <fstream>
 #include <filesystem>
-#include <vector>
\ No newline at end of file
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <string>
+#include <unordered_map>
\ No newline at end of file
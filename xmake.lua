@@ -21,3 +21,14 @@ set_optimize("faster")
       add_cxflags("/MTd")
     end
   end
+
+  -- Hook overhead microbenchmark (Linux only)
+  -- xmake f -p linux && xmake build HookBench && xmake run HookBench hookbench.json
+  if is_plat("linux") then
+    target("HookBench")
+      set_kind("binary")
+      set_default(false)
+      add_files("bench/hookbench.cpp", "external/safetyhook/safetyhook.cpp", "external/safetyhook/Zydis.c")
+      add_includedirs("external/safetyhook")
+      add_syslinks("pthread")
+  end